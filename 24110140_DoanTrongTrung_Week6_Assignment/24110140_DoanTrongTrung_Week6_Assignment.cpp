@@ -4,6 +4,25 @@
 #include <memory>
 #include <algorithm>
 #include <iomanip>
+#include <random>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <fstream>
+#include <cmath>
+#include <string_view>
+#include <deque>
+#include <unordered_map>
+#include <cstdint>
+#include <type_traits>
+#include <optional>
+#include <new>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <set>
+#include <tuple>
+#include <limits>
 
 using namespace std;
 
@@ -14,24 +33,369 @@ public:
     virtual ~Discountable() = default;
 };
 
-// 
+// Global pool of interned strings (product names, brands)
+// Each distinct string is stored once; handles are small integers, so equality is an integer compare
+class StringPool {
+public:
+    using Handle = uint32_t;
+
+private:
+    mutable mutex poolMutex;
+    deque<string> strings;                    // deque keeps stored strings at stable addresses
+    unordered_map<string_view, Handle> handles;
+
+    StringPool() { intern(""); } // handle 0 is the empty string
+
+public:
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    static StringPool& instance() {
+        static StringPool pool;
+        return pool;
+    }
+
+    // Return handle of text, adding it to the pool on first use
+    Handle intern(string_view text) {
+        lock_guard<mutex> lock(poolMutex);
+        auto it = handles.find(text);
+        if (it != handles.end()) {
+            return it->second;
+        }
+        Handle handle = static_cast<Handle>(strings.size());
+        strings.emplace_back(text);
+        handles.emplace(strings.back(), handle);
+        return handle;
+    }
+
+    // Handle of text if already interned (never adds to the pool)
+    optional<Handle> find(string_view text) const {
+        lock_guard<mutex> lock(poolMutex);
+        auto it = handles.find(text);
+        return it != handles.end() ? optional<Handle>(it->second) : nullopt;
+    }
+
+    // View of interned string (valid for the lifetime of the program)
+    string_view view(Handle handle) const {
+        lock_guard<mutex> lock(poolMutex);
+        return handle < strings.size() ? string_view(strings[handle]) : string_view();
+    }
+
+    size_t size() const {
+        lock_guard<mutex> lock(poolMutex);
+        return strings.size();
+    }
+};
+
+class Product;
+
+// Abstract class for the product change feed (stock, price and brand mutations)
+class ProductObserver {
+public:
+    virtual void onStockChanged(const Product& product, int oldStock, int newStock) = 0;
+    virtual void onPriceChanged(const Product& product, double oldPrice, double newPrice) = 0;
+    virtual void onBrandChanged(const Product&, StringPool::Handle, StringPool::Handle) {}
+    virtual ~ProductObserver() = default;
+};
+
+// ===== INVENTORY STORAGE POLICIES =====
+
+// Detect pointer-like types whose pointee has getId() (e.g. shared_ptr<Product>)
+template<typename T, typename = void>
+struct HasArrowGetId : false_type {};
 template<typename T>
-class InventoryList {
+struct HasArrowGetId<T, void_t<decltype(declval<const T&>()->getId())>> : true_type {};
+
+// Detect types with their own getId()
+template<typename T, typename = void>
+struct HasGetId : false_type {};
+template<typename T>
+struct HasGetId<T, void_t<decltype(declval<const T&>().getId())>> : true_type {};
+
+// Default key: the ID for product-like items, the value itself otherwise (int, string, ...)
+template<typename T>
+decltype(auto) defaultKeyOf(const T& item) {
+    if constexpr (HasArrowGetId<T>::value) {
+        return item->getId();
+    } else if constexpr (HasGetId<T>::value) {
+        return item.getId();
+    } else {
+        return (item);
+    }
+}
+
+// Key-extractor trait (specialize for element types that need a different key)
+template<typename T>
+struct KeyExtractor {
+    using key_type = decay_t<decltype(defaultKeyOf(declval<const T&>()))>;
+    static decltype(auto) get(const T& item) { return defaultKeyOf(item); }
+};
+
+// Flat vector with linear lookup: best for short lists
+template<typename T, typename Key = KeyExtractor<T>>
+class FlatVectorStorage {
 private:
     vector<T> items;
 
 public:
+    using key_type = typename Key::key_type;
+    using key_extractor = Key;
+
+    void add(const T& item) { items.push_back(item); }
+
+    const T* find(const key_type& key) const {
+        for (const auto& item : items) {
+            if (Key::get(item) == key) {
+                return &item;
+            }
+        }
+        return nullptr;
+    }
+
+    bool remove(const key_type& key) {
+        for (auto it = items.begin(); it != items.end(); ++it) {
+            if (Key::get(*it) == key) {
+                items.erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const T* begin() const { return items.data(); }
+    const T* end() const { return items.data() + items.size(); }
+    size_t size() const { return items.size(); }
+    bool empty() const { return items.empty(); }
+};
+
+// Vector plus hash index: O(1) lookup by key, insertion order kept, O(n) removal
+template<typename T, typename Key = KeyExtractor<T>>
+class HashIndexedStorage {
+public:
+    using key_type = typename Key::key_type;
+    using key_extractor = Key;
+
+private:
+    vector<T> items;
+    unordered_map<key_type, size_t> index; // key -> position of first item with that key
+
+public:
+    void add(const T& item) {
+        index.emplace(Key::get(item), items.size());
+        items.push_back(item);
+    }
+
+    const T* find(const key_type& key) const {
+        auto it = index.find(key);
+        return it != index.end() ? &items[it->second] : nullptr;
+    }
+
+    bool remove(const key_type& key) {
+        auto it = index.find(key);
+        if (it == index.end()) {
+            return false;
+        }
+        key_type removedKey = it->first; // key may refer into the erased item
+        size_t pos = it->second;
+        index.erase(it);
+        items.erase(items.begin() + pos);
+        for (auto& entry : index) {
+            if (entry.second > pos) {
+                --entry.second;
+            }
+        }
+        // More items than keys means duplicates exist: index the next item with this key
+        if (items.size() > index.size()) {
+            for (size_t i = pos; i < items.size(); ++i) {
+                if (Key::get(items[i]) == removedKey) {
+                    index.emplace(removedKey, i);
+                    break;
+                }
+            }
+        }
+        return true;
+    }
+
+    const T* begin() const { return items.data(); }
+    const T* end() const { return items.data() + items.size(); }
+    size_t size() const { return items.size(); }
+    bool empty() const { return items.empty(); }
+};
+
+// Vector kept sorted by key (flat map): O(log n) lookup, iteration in key order
+template<typename T, typename Key = KeyExtractor<T>>
+class SortedVectorStorage {
+private:
+    vector<T> items;
+
+    struct KeyLess {
+        template<typename A, typename B>
+        bool operator()(const A& a, const B& b) const { return keyOf(a) < keyOf(b); }
+
+        static decltype(auto) keyOf(const T& item) { return Key::get(item); }
+        template<typename K>
+        static const K& keyOf(const K& key) { return key; }
+    };
+
+    typename vector<T>::const_iterator lowerBound(const typename Key::key_type& key) const {
+        return lower_bound(items.begin(), items.end(), key, KeyLess());
+    }
+
+public:
+    using key_type = typename Key::key_type;
+    using key_extractor = Key;
+
+    void add(const T& item) {
+        // Insert after equal keys so duplicates keep insertion order
+        items.insert(upper_bound(items.begin(), items.end(), item, KeyLess()), item);
+    }
+
+    const T* find(const key_type& key) const {
+        auto it = lowerBound(key);
+        return (it != items.end() && !(key < Key::get(*it))) ? &*it : nullptr;
+    }
+
+    bool remove(const key_type& key) {
+        auto it = lowerBound(key);
+        if (it == items.end() || key < Key::get(*it)) {
+            return false;
+        }
+        items.erase(it);
+        return true;
+    }
+
+    const T* begin() const { return items.data(); }
+    const T* end() const { return items.data() + items.size(); }
+    size_t size() const { return items.size(); }
+    bool empty() const { return items.empty(); }
+};
+
+// First N items stored inline (no heap allocation), spills to a vector beyond that
+template<typename T, size_t N = 8, typename Key = KeyExtractor<T>>
+class SmallInlineStorage {
+private:
+    alignas(T) unsigned char buffer[N * sizeof(T)];
+    size_t inlineCount = 0;
+    vector<T> overflow; // holds all items once size exceeds N
+
+    // Raw address of slot i, for constructing an item there
+    void* slot(size_t i) { return buffer + i * sizeof(T); }
+
+    // Live inline items (only valid while inlineCount > 0)
+    T* inlineData() { return launder(reinterpret_cast<T*>(buffer)); }
+    const T* inlineData() const { return launder(reinterpret_cast<const T*>(buffer)); }
+    T* data() { return overflow.empty() ? inlineData() : overflow.data(); }
+
+    void destroyInline() {
+        for (size_t i = 0; i < inlineCount; ++i) {
+            inlineData()[i].~T();
+        }
+        inlineCount = 0;
+    }
+
+    void copyFrom(const SmallInlineStorage& other) {
+        for (size_t i = 0; i < other.inlineCount; ++i) {
+            new (slot(i)) T(other.inlineData()[i]);
+            ++inlineCount;
+        }
+        overflow = other.overflow;
+    }
+
+public:
+    using key_type = typename Key::key_type;
+    using key_extractor = Key;
+
+    SmallInlineStorage() = default;
+    SmallInlineStorage(const SmallInlineStorage& other) { copyFrom(other); }
+    SmallInlineStorage& operator=(const SmallInlineStorage& other) {
+        if (this != &other) {
+            destroyInline();
+            overflow.clear();
+            copyFrom(other);
+        }
+        return *this;
+    }
+    ~SmallInlineStorage() { destroyInline(); }
+
+    void add(const T& item) {
+        if (overflow.empty() && inlineCount < N) {
+            new (slot(inlineCount)) T(item);
+            ++inlineCount;
+            return;
+        }
+        if (overflow.empty()) {
+            // Spill inline items to the heap
+            overflow.reserve(2 * N);
+            for (size_t i = 0; i < inlineCount; ++i) {
+                overflow.push_back(move(inlineData()[i]));
+            }
+            destroyInline();
+        }
+        overflow.push_back(item);
+    }
+
+    const T* find(const key_type& key) const {
+        for (const T* it = begin(); it != end(); ++it) {
+            if (Key::get(*it) == key) {
+                return it;
+            }
+        }
+        return nullptr;
+    }
+
+    bool remove(const key_type& key) {
+        const T* found = find(key);
+        if (!found) {
+            return false;
+        }
+        size_t pos = static_cast<size_t>(found - begin());
+        if (!overflow.empty()) {
+            overflow.erase(overflow.begin() + pos);
+            return true;
+        }
+        T* items = data();
+        for (size_t i = pos; i + 1 < inlineCount; ++i) {
+            items[i] = move(items[i + 1]);
+        }
+        items[--inlineCount].~T();
+        return true;
+    }
+
+    const T* begin() const {
+        if (!overflow.empty()) {
+            return overflow.data();
+        }
+        return inlineCount > 0 ? inlineData() : nullptr;
+    }
+    const T* end() const { return begin() + size(); }
+    size_t size() const { return overflow.empty() ? inlineCount : overflow.size(); }
+    bool empty() const { return size() == 0; }
+};
+
+// Default storage per element type: hash index for ID-keyed items (catalog lookups by ID),
+// flat vector for plain values and short lists
+template<typename T>
+using DefaultStorage = conditional_t<HasArrowGetId<T>::value || HasGetId<T>::value,
+                                     HashIndexedStorage<T>, FlatVectorStorage<T>>;
+
+// Inventory container; Storage selects the lookup strategy at compile time
+template<typename T, typename Storage = DefaultStorage<T>>
+class InventoryList {
+private:
+    Storage items;
+
+public:
+    using key_type = typename Storage::key_type;
+
     // Add item to inventory
     void addItem(const T& item) {
-        items.push_back(item);
+        items.add(item);
         cout << "Item added to inventory list.\n";
     }
 
-    // Remove item from inventory
+    // Remove item from inventory (matched by key)
     bool removeItem(const T& item) {
-        auto it = find(items.begin(), items.end(), item);
-        if (it != items.end()) {
-            items.erase(it);
+        if (items.remove(Storage::key_extractor::get(item))) {
             cout << "Item removed from inventory list.\n";
             return true;
         }
@@ -39,26 +403,36 @@ public:
         return false;
     }
 
-    // Search for item in inventory
+    // Search for item in inventory (matched by key)
     bool searchItem(const T& item) const {
-        return find(items.begin(), items.end(), item) != items.end();
+        return items.find(Storage::key_extractor::get(item)) != nullptr;
+    }
+
+    // Find item by key; nullptr if not found
+    const T* findByKey(const key_type& key) const {
+        return items.find(key);
+    }
+
+    // Mutable lookup for in-place updates (caller must not change the item's key)
+    T* findByKey(const key_type& key) {
+        return const_cast<T*>(items.find(key));
     }
     
-    // Search by ID for products 
-    T searchById(int id) {
-        for (const auto& item : items) {
-            if (item->getId() == id) {
-                return item;
-            }
-        }
-        return nullptr;
+    // Search by ID (the item's key: product ID, or the value itself for int/string lists)
+    optional<T> searchById(const key_type& id) const {
+        const T* found = items.find(id);
+        return found ? optional<T>(*found) : nullopt;
     }
 
     // Get all items
     vector<T> getAllItems() const {
-        return items;
+        return vector<T>(items.begin(), items.end());
     }
 
+    // Iterate without copying
+    const T* begin() const { return items.begin(); }
+    const T* end() const { return items.end(); }
+
     // Get size of inventory
     size_t size() const {
         return items.size();
@@ -72,8 +446,9 @@ public:
     // Display all items 
     void displayAll() const {
         cout << "Inventory List contains " << items.size() << " items:\n";
-        for (size_t i = 0; i < items.size(); ++i) {
-            cout << "Item " << (i + 1) << ": " << items[i] << "\n";
+        size_t i = 0;
+        for (const auto& item : items) {
+            cout << "Item " << ++i << ": " << item << "\n";
         }
     }
 };
@@ -82,27 +457,62 @@ public:
 class Product : public Discountable {
 protected:
     int id;
-    string name;
+    StringPool::Handle nameId;
+    string_view name; // cached view into StringPool, avoids a pool lookup per access
     double price;
     int stock;
+    vector<ProductObserver*> observers; // change feed subscribers (not copied with the product)
+
+    void notifyPriceChanged(double oldPrice) const {
+        for (ProductObserver* observer : observers) {
+            observer->onPriceChanged(*this, oldPrice, price);
+        }
+    }
 
 public:
-    Product(int id = 0, const string& name = "", double price = 0, int stock = 0) 
-        : id(id), name(name), price(price), stock(stock) {}
+    Product(int id = 0, string_view name = "", double price = 0, int stock = 0) 
+        : id(id), nameId(StringPool::instance().intern(name)), 
+          name(StringPool::instance().view(nameId)), price(price), stock(stock) {}
+
+    Product(const Product& other) 
+        : Discountable(other), id(other.id), nameId(other.nameId), name(other.name), 
+          price(other.price), stock(other.stock) {}
 
     // Virtual destructor for proper inheritance cleanup
     virtual ~Product() = default;
 
+    // Change feed subscription (observer must unsubscribe before it is destroyed)
+    void addObserver(ProductObserver* observer) {
+        observers.push_back(observer);
+    }
+
+    void removeObserver(ProductObserver* observer) {
+        observers.erase(remove(observers.begin(), observers.end(), observer), observers.end());
+    }
+
+    // Publish a stock change; called by every stock mutation (and by batch callers once per product)
+    void notifyStockChanged(int oldStock) const {
+        if (oldStock == stock) {
+            return;
+        }
+        for (ProductObserver* observer : observers) {
+            observer->onStockChanged(*this, oldStock, stock);
+        }
+    }
+
     // Getter methods
     int getId() const { return id; }
-    string getName() const { return name; }
+    string_view getName() const { return name; }
+    StringPool::Handle getNameId() const { return nameId; }
     double getPrice() const { return price; }
     int getStock() const { return stock; }
 
     // Setter methods
     void setPrice(double newPrice) { 
         if (newPrice >= 0) {
+            double oldPrice = price;
             price = newPrice; 
+            notifyPriceChanged(oldPrice);
             cout << "Price updated to $" << newPrice << "\n";
         } else {
             cout << "Error: Price cannot be negative.\n";
@@ -111,19 +521,35 @@ public:
     
     void setStock(int newStock) { 
         if (newStock >= 0) {
+            int oldStock = stock;
             stock = newStock; 
+            notifyStockChanged(oldStock);
             cout << "Stock updated to " << newStock << "\n";
         } else {
             cout << "Error: Stock cannot be negative.\n";
         }
     }
 
+    // Apply stock change without console output; false if stock would go below 0 or overflow.
+    // With notify = false the caller must publish the net change via notifyStockChanged.
+    bool tryUpdateStock(int quantity, bool notify = true) {
+        if (quantity > numeric_limits<int>::max() - stock || stock + quantity < 0) {
+            return false;
+        }
+        stock += quantity;
+        if (notify) {
+            notifyStockChanged(stock - quantity);
+        }
+        return true;
+    }
+
     // Virtual method for stock updates (can be overridden by derived classes)
     virtual void updateStock(int quantity) {
-        if (stock + quantity >= 0) {
-            stock += quantity;
+        if (tryUpdateStock(quantity)) {
             cout << "Stock updated: " << (quantity > 0 ? "+" : "") << quantity 
                  << " (New stock: " << stock << ")\n";
+        } else if (quantity > 0) {
+            cout << "Error: Stock update would exceed maximum stock. Current stock: " << stock << "\n";
         } else {
             cout << "Error: Cannot reduce stock below 0. Current stock: " << stock << "\n";
         }
@@ -176,10 +602,17 @@ public:
     // Assignment operator
     Product& operator=(const Product& other) {
         if (this != &other) {
+            double oldPrice = price;
+            int oldStock = stock;
             id = other.id;
+            nameId = other.nameId;
             name = other.name;
             price = other.price;
             stock = other.stock;
+            if (oldPrice != price) {
+                notifyPriceChanged(oldPrice);
+            }
+            notifyStockChanged(oldStock);
             cout << "Product assigned successfully.\n";
         }
         return *this;
@@ -198,27 +631,51 @@ public:
 class Electronics : public Product {
 private:
     int warrantyPeriod; // in months
-    string brand;
+    StringPool::Handle brandId;
+    string_view brand; // cached view into StringPool
 
 public:
-    Electronics(int id = 0, const string& name = "", double price = 0.0, int stock = 0, 
-                int warranty = 0, const string& brand = "")
-        : Product(id, name, price, stock), warrantyPeriod(warranty), brand(brand) {}
+    Electronics(int id = 0, string_view name = "", double price = 0.0, int stock = 0, 
+                int warranty = 0, string_view brand = "")
+        : Product(id, name, price, stock), warrantyPeriod(warranty), 
+          brandId(StringPool::instance().intern(brand)), 
+          brand(StringPool::instance().view(brandId)) {}
 
     // Getter methods 
     int getWarrantyPeriod() const { return warrantyPeriod; }
-    string getBrand() const { return brand; }
+    string_view getBrand() const { return brand; }
+    StringPool::Handle getBrandId() const { return brandId; } // compare brands by handle
+
+    Electronics(const Electronics&) = default;
+
+    // Assignment operator (publishes the brand change after Product's price/stock events)
+    Electronics& operator=(const Electronics& other) {
+        if (this != &other) {
+            Product::operator=(other);
+            StringPool::Handle oldBrandId = brandId;
+            warrantyPeriod = other.warrantyPeriod;
+            brandId = other.brandId;
+            brand = other.brand;
+            if (oldBrandId != brandId) {
+                for (ProductObserver* observer : observers) {
+                    observer->onBrandChanged(*this, oldBrandId, brandId);
+                }
+            }
+        }
+        return *this;
+    }
 
     // Override updateStock 
     void updateStock(int quantity) override {
-        if (stock + quantity >= 0) {
-            stock += quantity;
+        if (tryUpdateStock(quantity)) {
             cout << "Electronics stock updated: " << (quantity > 0 ? "+" : "") << quantity 
                  << " (New stock: " << stock << ")\n";
             // Electronics-specific handling fee for stock reduction
             if (quantity < 0) {
                 cout << "*** Electronics handling fee of $5 applied for stock reduction ***\n";
             }
+        } else if (quantity > 0) {
+            cout << "Error: Electronics stock update would exceed maximum stock. Current stock: " << stock << "\n";
         } else {
             cout << "Error: Cannot reduce electronics stock below 0. Current stock: " << stock << "\n";
         }
@@ -252,6 +709,231 @@ public:
     }
 };
 
+// Product categories tracked by InventoryViews
+enum class ProductCategory { General, Electronics };
+
+// Materialized inventory views kept up to date from the product change feed.
+// Queries are O(1) (or O(log n + k) for ordered low-stock lists) instead of rescanning the catalog.
+// Updates are lock-free on the common path: totals and counts are relaxed atomics, and only
+// products below indexedStockCeiling sit in the ordered stock index (the one part under a mutex).
+// A product is mutated by one thread at a time (as in batch updates); track() must not run
+// concurrently with product mutations.
+class InventoryViews : public ProductObserver {
+private:
+    // Compact per-product state, so an update touches little more than one hash node
+    struct Entry {
+        atomic<int> stock;
+        int id;                     // ID at track time (orders the stock index)
+        double price;
+        atomic<double>* brandTotal; // slot in brandValue (nullptr for non-electronics)
+        uint32_t productSlot;       // index into products
+        ProductCategory category;
+
+        Entry(int stock, int id, double price, atomic<double>* brandTotal, 
+              uint32_t productSlot, ProductCategory category)
+            : stock(stock), id(id), price(price), brandTotal(brandTotal), 
+              productSlot(productSlot), category(category) {}
+    };
+
+    mutable mutex viewMutex; // guards byStock, brandValue inserts and tracking
+    int lowStockThreshold;
+    int indexedStockCeiling;
+    vector<shared_ptr<Product>> products;
+    unordered_map<const Product*, Entry> entries;
+    set<tuple<int, int, const Product*>> byStock; // (stock, ID, product) for products below the ceiling
+    atomic<double> totalValue{0.0};
+    atomic<double> categoryValue[2] = {{0.0}, {0.0}};
+    unordered_map<StringPool::Handle, atomic<double>> brandValue; // node-based, so slot pointers stay valid
+    atomic<size_t> outOfStockCount{0};
+    atomic<size_t> lowStockCount{0};
+
+    static void atomicAdd(atomic<double>& target, double value) {
+        double current = target.load(memory_order_relaxed);
+        while (!target.compare_exchange_weak(current, current + value, memory_order_relaxed)) {
+        }
+    }
+
+    void addValue(const Entry& entry, double value) {
+        atomicAdd(totalValue, value);
+        atomicAdd(categoryValue[static_cast<int>(entry.category)], value);
+        if (entry.brandTotal) {
+            atomicAdd(*entry.brandTotal, value);
+        }
+    }
+
+    // Adjust counters only when a stock change crosses the out-of-stock or low-stock boundary
+    void countStock(int oldStock, int newStock) {
+        if ((oldStock == 0) != (newStock == 0)) {
+            newStock == 0 ? outOfStockCount++ : outOfStockCount--;
+        }
+        if ((oldStock < lowStockThreshold) != (newStock < lowStockThreshold)) {
+            newStock < lowStockThreshold ? lowStockCount++ : lowStockCount--;
+        }
+    }
+
+    atomic<double>* brandSlotLocked(StringPool::Handle brandId) {
+        return &brandValue.try_emplace(brandId, 0.0).first->second;
+    }
+
+    vector<shared_ptr<Product>> productsBelowLocked(int units) const {
+        vector<shared_ptr<Product>> result;
+        if (units > indexedStockCeiling) {
+            // Above the indexed range: scan and sort (rare, dashboards ask for low stock)
+            vector<tuple<int, int, const Product*>> matches;
+            for (const auto& entry : entries) {
+                int stock = entry.second.stock.load(memory_order_relaxed);
+                if (stock < units) {
+                    matches.emplace_back(stock, entry.second.id, entry.first);
+                }
+            }
+            sort(matches.begin(), matches.end());
+            for (const auto& match : matches) {
+                result.push_back(products[entries.at(get<2>(match)).productSlot]);
+            }
+            return result;
+        }
+        auto end = byStock.lower_bound(make_tuple(units, numeric_limits<int>::min(), nullptr));
+        for (auto it = byStock.begin(); it != end; ++it) {
+            result.push_back(products[entries.at(get<2>(*it)).productSlot]);
+        }
+        return result;
+    }
+
+public:
+    explicit InventoryViews(int lowStockThreshold = 5, int indexedStockCeiling = 50)
+        : lowStockThreshold(lowStockThreshold), 
+          indexedStockCeiling(max(lowStockThreshold, indexedStockCeiling)) {}
+
+    InventoryViews(const InventoryViews&) = delete;
+    InventoryViews& operator=(const InventoryViews&) = delete;
+
+    ~InventoryViews() {
+        for (auto& product : products) {
+            product->removeObserver(this);
+        }
+    }
+
+    // Start maintaining views for product (ignored if null or already tracked)
+    void track(const shared_ptr<Product>& product) {
+        if (!product) {
+            return;
+        }
+        lock_guard<mutex> lock(viewMutex);
+        if (entries.count(product.get())) {
+            return;
+        }
+        auto electronics = dynamic_pointer_cast<Electronics>(product);
+        Entry& entry = entries.try_emplace(product.get(), product->getStock(), product->getId(), 
+            product->getPrice(), electronics ? brandSlotLocked(electronics->getBrandId()) : nullptr,
+            static_cast<uint32_t>(products.size()),
+            electronics ? ProductCategory::Electronics : ProductCategory::General).first->second;
+        products.push_back(product);
+
+        int stock = entry.stock.load(memory_order_relaxed);
+        addValue(entry, entry.price * stock);
+        outOfStockCount += (stock == 0) ? 1 : 0;
+        lowStockCount += (stock < lowStockThreshold) ? 1 : 0;
+        if (stock < indexedStockCeiling) {
+            byStock.emplace(stock, entry.id, product.get());
+        }
+        product->addObserver(this);
+    }
+
+    void onStockChanged(const Product& product, int, int newStock) override {
+        auto it = entries.find(&product);
+        if (it == entries.end()) {
+            return;
+        }
+        Entry& entry = it->second;
+        int oldStock = entry.stock.load(memory_order_relaxed);
+        if (oldStock == newStock) {
+            return;
+        }
+        addValue(entry, entry.price * (newStock - oldStock));
+        countStock(oldStock, newStock);
+        entry.stock.store(newStock, memory_order_relaxed);
+
+        // Touch the ordered index only when the product is (or becomes) low enough to be in it
+        if (oldStock < indexedStockCeiling || newStock < indexedStockCeiling) {
+            lock_guard<mutex> lock(viewMutex);
+            if (oldStock < indexedStockCeiling) {
+                byStock.erase(make_tuple(oldStock, entry.id, &product));
+            }
+            if (newStock < indexedStockCeiling) {
+                byStock.emplace(newStock, entry.id, &product);
+            }
+        }
+    }
+
+    void onPriceChanged(const Product& product, double, double newPrice) override {
+        auto it = entries.find(&product);
+        if (it == entries.end()) {
+            return;
+        }
+        Entry& entry = it->second;
+        addValue(entry, (newPrice - entry.price) * entry.stock.load(memory_order_relaxed));
+        entry.price = newPrice;
+    }
+
+    void onBrandChanged(const Product& product, StringPool::Handle, StringPool::Handle newBrandId) override {
+        lock_guard<mutex> lock(viewMutex);
+        auto it = entries.find(&product);
+        if (it == entries.end() || !it->second.brandTotal) {
+            return;
+        }
+        // Move this product's value from the old brand to the new one
+        Entry& entry = it->second;
+        double value = entry.price * entry.stock.load(memory_order_relaxed);
+        atomicAdd(*entry.brandTotal, -value);
+        entry.brandTotal = brandSlotLocked(newBrandId);
+        atomicAdd(*entry.brandTotal, value);
+    }
+
+    // ===== QUERIES =====
+    // Each value is exact once updates quiesce; during a parallel batch each is read independently
+
+    double getTotalValue() const {
+        return totalValue.load(memory_order_relaxed);
+    }
+
+    double getCategoryValue(ProductCategory category) const {
+        return categoryValue[static_cast<int>(category)].load(memory_order_relaxed);
+    }
+
+    double getBrandValue(StringPool::Handle brandId) const {
+        lock_guard<mutex> lock(viewMutex);
+        auto it = brandValue.find(brandId);
+        return it != brandValue.end() ? it->second.load(memory_order_relaxed) : 0.0;
+    }
+
+    double getBrandValue(string_view brand) const {
+        optional<StringPool::Handle> brandId = StringPool::instance().find(brand);
+        return brandId ? getBrandValue(*brandId) : 0.0;
+    }
+
+    size_t getOutOfStockCount() const {
+        return outOfStockCount.load(memory_order_relaxed);
+    }
+
+    int getLowStockThreshold() const { return lowStockThreshold; }
+
+    size_t getLowStockCount() const {
+        return lowStockCount.load(memory_order_relaxed);
+    }
+
+    // Products below the low-stock threshold, lowest stock first
+    vector<shared_ptr<Product>> getLowStockProducts() const {
+        lock_guard<mutex> lock(viewMutex);
+        return productsBelowLocked(lowStockThreshold);
+    }
+
+    // Products with fewer than units in stock, lowest stock first
+    vector<shared_ptr<Product>> getProductsBelow(int units) const {
+        lock_guard<mutex> lock(viewMutex);
+        return productsBelowLocked(units);
+    }
+};
+
 // 
 class CartItem {
 private:
@@ -299,16 +981,25 @@ public:
     }
 };
 
+// Cart items are keyed by their product ID
+template<>
+struct KeyExtractor<CartItem> {
+    using key_type = int;
+    static int get(const CartItem& item) { return item.getProduct()->getId(); }
+};
+
 // ShoppingCart class 
 class ShoppingCart : public Discountable {
 private:
-    InventoryList<CartItem> cartItems;
+    // Carts hold a handful of lines, so they live inline without heap allocation
+    using CartList = InventoryList<CartItem, SmallInlineStorage<CartItem>>;
+    CartList cartItems;
     double totalAmount;
 
     // Private method to recalculate total amount
     void calculateTotal() {
         totalAmount = 0.0;
-        for (const auto& item : cartItems.getAllItems()) {
+        for (const auto& item : cartItems) {
             totalAmount += item.getTotalPrice();
         }
     }
@@ -341,22 +1032,11 @@ public:
             return *this;
         }
 
-        // Check if product already exists in cart
-        bool found = false;
-        vector<CartItem> items = cartItems.getAllItems();
-        
-        cartItems = InventoryList<CartItem>(); // Clear current items
-        
-        for (auto& item : items) {
-            if (*(item.getProduct()) == *product) {
-                // Update existing item quantity
-                item.setQuantity(item.getQuantity() + quantity);
-                found = true;
-            }
-            cartItems.addItem(item); // Re-add item
-        }
-
-        if (!found) {
+        // Update existing item quantity in place if product already in cart
+        CartItem* existing = cartItems.findByKey(product->getId());
+        if (existing) {
+            existing->setQuantity(existing->getQuantity() + quantity);
+        } else {
             // Add new item to cart
             CartItem newItem(product, quantity);
             cartItems.addItem(newItem);
@@ -378,22 +1058,13 @@ public:
             return *this;
         }
 
-        vector<CartItem> items = cartItems.getAllItems();
-        cartItems = InventoryList<CartItem>(); // Clear current items
-        
-        bool found = false;
-        for (const auto& item : items) {
-            if (*(item.getProduct()) == *product) {
-                // Return stock to product and skip re-adding this item
-                product->updateStock(item.getQuantity());
-                found = true;
-                cout << " Removed " << product->getName() << " from cart.\n";
-            } else {
-                cartItems.addItem(item); // Re-add other items
-            }
-        }
-
-        if (!found) {
+        const CartItem* existing = cartItems.findByKey(product->getId());
+        if (existing) {
+            // Return stock to product and drop the cart line
+            product->updateStock(existing->getQuantity());
+            cout << " Removed " << product->getName() << " from cart.\n";
+            cartItems.removeItem(*existing);
+        } else {
             cout << "Error: Product " << product->getName() << " not found in cart.\n";
         }
 
@@ -455,7 +1126,7 @@ public:
         for (const auto& item : cartItems.getAllItems()) {
             item.getProduct()->updateStock(item.getQuantity());
         }
-        cartItems = InventoryList<CartItem>();
+        cartItems = CartList();
         totalAmount = 0.0;
         cout << "Cart cleared successfully.\n";
     }
@@ -505,18 +1176,172 @@ public:
 // Initialize static member
 int Order::nextOrderId = 1;
 
+// Thread pool with per-worker deques: owners pop from the back, idle workers steal from the front
+class WorkStealingPool {
+private:
+    struct WorkerQueue {
+        mutex queueMutex;
+        deque<function<void()>> tasks;
+    };
+
+    vector<unique_ptr<WorkerQueue>> queues;
+    vector<thread> workers;
+    atomic<size_t> pendingTasks{0};
+    atomic<size_t> nextQueue{0};
+    atomic<bool> stopping{false};
+    mutex sleepMutex;
+    condition_variable wakeUp;
+
+    bool popOwn(size_t index, function<void()>& task) {
+        WorkerQueue& queue = *queues[index];
+        lock_guard<mutex> lock(queue.queueMutex);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+        task = move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return true;
+    }
+
+    bool steal(size_t thief, function<void()>& task) {
+        for (size_t offset = 1; offset < queues.size(); ++offset) {
+            WorkerQueue& victim = *queues[(thief + offset) % queues.size()];
+            lock_guard<mutex> lock(victim.queueMutex);
+            if (!victim.tasks.empty()) {
+                task = move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void workerLoop(size_t index) {
+        function<void()> task;
+        while (true) {
+            if (popOwn(index, task) || steal(index, task)) {
+                pendingTasks--;
+                task();
+                continue;
+            }
+            unique_lock<mutex> lock(sleepMutex);
+            wakeUp.wait(lock, [this]() { return stopping || pendingTasks > 0; });
+            if (stopping && pendingTasks == 0) {
+                return;
+            }
+        }
+    }
+
+public:
+    explicit WorkStealingPool(size_t threadCount = max(1u, thread::hardware_concurrency())) {
+        for (size_t i = 0; i < threadCount; ++i) {
+            queues.push_back(make_unique<WorkerQueue>());
+        }
+        for (size_t i = 0; i < threadCount; ++i) {
+            workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    ~WorkStealingPool() {
+        {
+            lock_guard<mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wakeUp.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    // Shared pool used for batch operations
+    static WorkStealingPool& shared() {
+        static WorkStealingPool pool;
+        return pool;
+    }
+
+    size_t getThreadCount() const { return workers.size(); }
+
+    // Queue task on the next worker (round-robin)
+    void submit(function<void()> task) {
+        WorkerQueue& queue = *queues[nextQueue++ % queues.size()];
+        {
+            lock_guard<mutex> lock(queue.queueMutex);
+            queue.tasks.push_back(move(task));
+            pendingTasks++; // counted before any worker can pop it
+        }
+        {
+            lock_guard<mutex> lock(sleepMutex); // pairs with the wait in workerLoop, so no wakeup is lost
+        }
+        wakeUp.notify_one();
+    }
+
+    // Run body(begin, end) over [0, count) in chunks of about grain, blocking until all finish
+    void parallelFor(size_t count, size_t grain, const function<void(size_t, size_t)>& body) {
+        if (count == 0) {
+            return;
+        }
+        grain = max<size_t>(grain, 1);
+        size_t chunks = (count + grain - 1) / grain;
+        size_t remaining = chunks; // guarded by doneMutex
+        mutex doneMutex;
+        condition_variable done;
+
+        for (size_t begin = 0; begin < count; begin += grain) {
+            size_t end = min(begin + grain, count);
+            submit([&, begin, end]() {
+                body(begin, end);
+                lock_guard<mutex> lock(doneMutex);
+                if (--remaining == 0) {
+                    done.notify_one();
+                }
+            });
+        }
+
+        unique_lock<mutex> lock(doneMutex);
+        done.wait(lock, [&]() { return remaining == 0; });
+    }
+};
+
+// Outcome of one entry in a batch stock update
+enum class StockDeltaStatus { Applied, ProductNotFound, InsufficientStock, StockOverflow };
+
+struct StockDeltaResult {
+    int productId;
+    int delta;
+    StockDeltaStatus status;
+    int stockAfter; // stock after this entry (unchanged if rejected, -1 if product not found)
+
+    bool succeeded() const { return status == StockDeltaStatus::Applied; }
+};
+
 // Main system manager class 
 class ECommerceManager {
 private:
+    // Catalog lookups by ID go through a hash index (DefaultStorage for ID-keyed items)
     InventoryList<shared_ptr<Product>> inventory;
     ShoppingCart cart;
     vector<Order> orderHistory;
+    shared_ptr<InventoryViews> views; // dashboards: low stock, inventory value, out-of-stock counts
+    bool viewTracking = true;
 
 public:
+    // Managers that share one catalog should share one views instance (one subscriber per product)
+    explicit ECommerceManager(shared_ptr<InventoryViews> sharedViews = make_shared<InventoryViews>())
+        : views(sharedViews ? sharedViews : make_shared<InventoryViews>()) {}
+
+    // Enable/disable view maintenance for products added from now on (load runs measure its cost)
+    void setViewTracking(bool enabled) { viewTracking = enabled; }
+
     // Add product to main inventory
     void addProductToInventory(shared_ptr<Product> product) {
         if (product) {
             inventory.addItem(product);
+            if (viewTracking) {
+                views->track(product);
+            }
             cout << "Added '" << product->getName() << "' to main inventory.\n";
         } else {
             cout << "Error: Cannot add null product to inventory.\n";
@@ -545,9 +1370,9 @@ public:
     // Add product to cart by ID
     void addToCart(int productId, int quantity) {
         cout << "\nAdding product ID " << productId << " (Qty: " << quantity << ") to cart...\n";
-        shared_ptr<Product> product = inventory.searchById(productId);
+        optional<shared_ptr<Product>> product = inventory.searchById(productId);
         if (product) {
-            cart += make_pair(product, quantity); // Uses += operator
+            cart += make_pair(*product, quantity); // Uses += operator
         } else {
             cout << "Error: Product with ID " << productId << " not found in inventory.\n";
         }
@@ -556,9 +1381,9 @@ public:
     // Remove product from cart by ID
     void removeFromCart(int productId) {
         cout << "\nRemoving product ID " << productId << " from cart...\n";
-        shared_ptr<Product> product = inventory.searchById(productId);
+        optional<shared_ptr<Product>> product = inventory.searchById(productId);
         if (product) {
-            cart -= product; // Uses -= operator
+            cart -= *product; // Uses -= operator
         } else {
             cout << "Error: Product with ID " << productId << " not found in inventory.\n";
         }
@@ -607,19 +1432,589 @@ public:
         cout << "=====================================\n";
     }
 
+    // Apply warehouse stock deltas (product ID, delta) as one batch.
+    // Deltas are grouped by product and groups run in parallel on the shared pool;
+    // within a product they apply in input order with the same non-negative check as updateStock.
+    // Must not run concurrently with other operations on the same products.
+    vector<StockDeltaResult> applyStockDeltas(const vector<pair<int, int>>& deltas) {
+        vector<StockDeltaResult> results(deltas.size());
+
+        // Group entry indices by product (counting sort keeps input order within a group)
+        unordered_map<int, size_t> groupOf;
+        vector<shared_ptr<Product>> groupProducts;
+        vector<size_t> entryGroup(deltas.size());
+        vector<size_t> groupStart(1, 0);
+        for (size_t i = 0; i < deltas.size(); ++i) {
+            int productId = deltas[i].first;
+            auto it = groupOf.find(productId);
+            if (it == groupOf.end()) {
+                const shared_ptr<Product>* product = inventory.findByKey(productId);
+                it = groupOf.emplace(productId, groupProducts.size()).first;
+                groupProducts.push_back(product ? *product : nullptr);
+                groupStart.push_back(0);
+            }
+            entryGroup[i] = it->second;
+            groupStart[it->second + 1]++;
+        }
+        for (size_t g = 1; g < groupStart.size(); ++g) {
+            groupStart[g] += groupStart[g - 1];
+        }
+        vector<size_t> order(deltas.size());
+        vector<size_t> fill(groupStart.begin(), groupStart.end() - 1);
+        for (size_t i = 0; i < deltas.size(); ++i) {
+            order[fill[entryGroup[i]]++] = i;
+        }
+
+        // Each group touches only its own product, so groups need no locking
+        WorkStealingPool::shared().parallelFor(groupProducts.size(), 64, [&](size_t begin, size_t end) {
+            for (size_t g = begin; g < end; ++g) {
+                Product* product = groupProducts[g].get();
+                int stockBefore = product ? product->getStock() : 0;
+                for (size_t k = groupStart[g]; k < groupStart[g + 1]; ++k) {
+                    size_t i = order[k];
+                    StockDeltaResult& result = results[i];
+                    result.productId = deltas[i].first;
+                    result.delta = deltas[i].second;
+                    if (!product) {
+                        result.status = StockDeltaStatus::ProductNotFound;
+                        result.stockAfter = -1;
+                    } else {
+                        if (product->tryUpdateStock(deltas[i].second, false)) {
+                            result.status = StockDeltaStatus::Applied;
+                        } else {
+                            result.status = deltas[i].second > 0
+                                ? StockDeltaStatus::StockOverflow : StockDeltaStatus::InsufficientStock;
+                        }
+                        result.stockAfter = product->getStock();
+                    }
+                }
+                // One net change-feed event per product instead of one per delta
+                if (product) {
+                    product->notifyStockChanged(stockBefore);
+                }
+            }
+        });
+
+        size_t applied = count_if(results.begin(), results.end(),
+                                  [](const StockDeltaResult& r) { return r.succeeded(); });
+        cout << "Batch stock update: " << applied << " applied, " 
+             << (results.size() - applied) << " rejected across " << groupProducts.size() << " products.\n";
+        return results;
+    }
+
     // Get inventory size
     size_t getInventorySize() const { return inventory.size(); }
     
     // Get cart item count
     size_t getCartItemCount() const { return cart.getItemCount(); }
 
+    // Get incrementally maintained inventory views
+    const InventoryViews& getInventoryViews() const {
+        return *views;
+    }
+
+    // Get all products in main inventory
+    vector<shared_ptr<Product>> getInventoryProducts() const {
+        return inventory.getAllItems();
+    }
+
     // Get reference to cart
     const ShoppingCart& getCart() const {
         return cart;
     }
 };
 
-int main() {
+// ===== LOAD GENERATION AND WORKLOAD REPLAY =====
+
+// Stream buffer that discards everything (silences console output during load runs)
+class NullBuffer : public streambuf {
+protected:
+    int overflow(int c) override { return c; }
+};
+
+// Kinds of shopper operations issued by the load generator
+enum class OperationType { AddToCart, RemoveFromCart, ApplyDiscount, Checkout };
+
+// One scheduled shopper operation
+struct WorkloadOperation {
+    long long offsetMicros; // scheduled time since start of run
+    int shopperId;
+    OperationType type;
+    int productId;
+    int quantity;
+    double discountRate;
+};
+
+// Settings for the synthetic catalog and traffic
+struct LoadConfig {
+    // Upper bounds for untrusted sizes (command-line options and trace files)
+    static constexpr int maxShoppers = 256;
+    static constexpr int maxCatalogSize = 1000000;
+    static constexpr long long maxOperations = 20000000;
+
+    int catalogSize = 1000;
+    double electronicsRatio = 0.3;  // share of catalog that is Electronics
+    double zipfExponent = 1.0;      // popularity skew (0 = uniform)
+    int initialStock = 100;
+    int shoppers = 4;
+    int operationsPerShopper = 2000;
+    double targetRate = 10000.0;    // total operations per second
+    unsigned seed = 42;
+
+    // Range check for --loadgen options
+    bool isValid() const {
+        return catalogSize > 0 && catalogSize <= maxCatalogSize &&
+               shoppers > 0 && shoppers <= maxShoppers && operationsPerShopper >= 0 &&
+               static_cast<long long>(shoppers) * operationsPerShopper <= maxOperations &&
+               targetRate > 0.0 && initialStock >= 0 &&
+               electronicsRatio >= 0.0 && electronicsRatio <= 1.0 && zipfExponent >= 0.0;
+    }
+};
+
+// One catalog row stored in a trace, so a replay runs against the identical catalog
+struct CatalogEntry {
+    int id;
+    bool electronics;
+    string name;
+    double price;
+    int stock;
+    int warranty; // electronics only
+    string brand; // electronics only
+};
+
+// Recorded catalog and sequence of operations
+class WorkloadTrace {
+private:
+    static constexpr int formatVersion = 2;
+    static constexpr long long maxOffsetMicros = 24LL * 3600 * 1000000; // one day
+
+    int shoppers;
+    vector<CatalogEntry> catalog;
+    vector<WorkloadOperation> operations;
+
+public:
+    WorkloadTrace(int shoppers = 0) : shoppers(shoppers) {}
+
+    void addCatalogEntry(const CatalogEntry& entry) {
+        catalog.push_back(entry);
+    }
+
+    void addOperation(const WorkloadOperation& operation) {
+        operations.push_back(operation);
+    }
+
+    int getShopperCount() const { return shoppers; }
+    const vector<CatalogEntry>& getCatalog() const { return catalog; }
+    const vector<WorkloadOperation>& getOperations() const { return operations; }
+
+    // Save trace as text: header (version, shoppers, row counts), one line per product, one per operation
+    bool saveToFile(const string& path) const {
+        ofstream out(path);
+        if (!out) {
+            cout << "Error: Cannot open trace file '" << path << "' for writing.\n";
+            return false;
+        }
+        // Full precision so a replay sees identical prices and discounts
+        out << setprecision(numeric_limits<double>::max_digits10);
+        out << "TRACE " << formatVersion << " " << shoppers << " "
+            << catalog.size() << " " << operations.size() << "\n";
+        for (const auto& entry : catalog) {
+            out << entry.id << " " << (entry.electronics ? 1 : 0) << " " << quoted(entry.name) << " "
+                << entry.price << " " << entry.stock << " " << entry.warranty << " "
+                << quoted(entry.brand) << "\n";
+        }
+        for (const auto& op : operations) {
+            out << op.offsetMicros << " " << op.shopperId << " " << static_cast<int>(op.type) << " "
+                << op.productId << " " << op.quantity << " " << op.discountRate << "\n";
+        }
+        return static_cast<bool>(out);
+    }
+
+    // Load trace written by saveToFile; rejects anything that does not match its header exactly
+    bool loadFromFile(const string& path) {
+        ifstream in(path);
+        if (!in) {
+            cout << "Error: Cannot open trace file '" << path << "' for reading.\n";
+            return false;
+        }
+        string tag;
+        int version = 0;
+        long long catalogCount = 0, operationCount = 0;
+        in >> tag >> version >> shoppers >> catalogCount >> operationCount;
+        if (!in || tag != "TRACE") {
+            cout << "Error: '" << path << "' is not a valid workload trace.\n";
+            return false;
+        }
+        if (version != formatVersion) {
+            cout << "Error: Trace '" << path << "' has unsupported format version " << version
+                 << " (expected " << formatVersion << ").\n";
+            return false;
+        }
+        if (shoppers <= 0 || shoppers > LoadConfig::maxShoppers ||
+            catalogCount <= 0 || catalogCount > LoadConfig::maxCatalogSize ||
+            operationCount < 0 || operationCount > LoadConfig::maxOperations) {
+            cout << "Error: Trace '" << path << "' has header values out of range.\n";
+            return false;
+        }
+
+        catalog.clear();
+        for (long long i = 0; i < catalogCount; ++i) {
+            CatalogEntry entry;
+            int electronics;
+            in >> entry.id >> electronics >> quoted(entry.name) >> entry.price
+               >> entry.stock >> entry.warranty >> quoted(entry.brand);
+            if (!in || (electronics != 0 && electronics != 1) ||
+                entry.price < 0.0 || entry.stock < 0 || entry.warranty < 0) {
+                cout << "Error: Malformed catalog line in trace '" << path << "'.\n";
+                return false;
+            }
+            entry.electronics = electronics == 1;
+            catalog.push_back(entry);
+        }
+
+        operations.clear();
+        for (long long i = 0; i < operationCount; ++i) {
+            WorkloadOperation op;
+            int type;
+            in >> op.offsetMicros >> op.shopperId >> type >> op.productId >> op.quantity >> op.discountRate;
+            if (!in) {
+                cout << "Error: Trace '" << path << "' declares " << operationCount
+                     << " operations but only " << i << " could be read.\n";
+                return false;
+            }
+            if (type < 0 || type > static_cast<int>(OperationType::Checkout) ||
+                op.shopperId < 0 || op.shopperId >= shoppers ||
+                op.offsetMicros < 0 || op.offsetMicros > maxOffsetMicros) {
+                cout << "Error: Invalid operation in trace '" << path << "'.\n";
+                return false;
+            }
+            op.type = static_cast<OperationType>(type);
+            operations.push_back(op);
+        }
+        if (!(in >> ws).eof()) {
+            cout << "Error: Trace '" << path << "' has more data than its header declares.\n";
+            return false;
+        }
+        return true;
+    }
+};
+
+// Builds the synthetic catalog and generates Zipf-distributed shopper traffic
+class WorkloadGenerator {
+private:
+    LoadConfig config;
+
+public:
+    WorkloadGenerator(const LoadConfig& config) : config(config) {}
+
+    // Create catalog rows deterministically from the config seed (IDs 1..catalogSize)
+    vector<CatalogEntry> buildCatalog() const {
+        static const vector<string> brands = {"ASUS", "Samsung", "Apple", "Dell", "Sony", "Lenovo"};
+        mt19937 rng(config.seed);
+        uniform_real_distribution<double> unit(0.0, 1.0);
+        uniform_real_distribution<double> priceDist(5.0, 2000.0);
+
+        vector<CatalogEntry> catalog;
+        catalog.reserve(config.catalogSize);
+        for (int id = 1; id <= config.catalogSize; ++id) {
+            double price = priceDist(rng);
+            if (unit(rng) < config.electronicsRatio) {
+                const string& brand = brands[rng() % brands.size()];
+                int warranty = 12 * static_cast<int>(1 + rng() % 3);
+                catalog.push_back({id, true, "Device " + to_string(id), price,
+                                   config.initialStock, warranty, brand});
+            } else {
+                catalog.push_back({id, false, "Item " + to_string(id), price,
+                                   config.initialStock, 0, ""});
+            }
+        }
+        return catalog;
+    }
+
+    // Generate an open-loop schedule: shoppers are staggered so the total rate matches targetRate
+    WorkloadTrace generateTrace() const {
+        WorkloadTrace trace(config.shoppers);
+        for (const auto& entry : buildCatalog()) {
+            trace.addCatalogEntry(entry);
+        }
+        mt19937 rng(config.seed + 1);
+        uniform_real_distribution<double> unit(0.0, 1.0);
+        uniform_int_distribution<int> quantityDist(1, 3);
+
+        // Zipf popularity: rank k has weight 1 / k^s
+        vector<double> cdf(config.catalogSize);
+        double sum = 0.0;
+        for (int k = 1; k <= config.catalogSize; ++k) {
+            sum += 1.0 / pow(static_cast<double>(k), config.zipfExponent);
+            cdf[k - 1] = sum;
+        }
+
+        double intervalMicros = 1e6 / config.targetRate;
+        for (int i = 0; i < config.operationsPerShopper; ++i) {
+            for (int shopper = 0; shopper < config.shoppers; ++shopper) {
+                WorkloadOperation op;
+                op.offsetMicros = static_cast<long long>((i * config.shoppers + shopper) * intervalMicros);
+                op.shopperId = shopper;
+                op.productId = static_cast<int>(lower_bound(cdf.begin(), cdf.end(), unit(rng) * sum)
+                                                - cdf.begin()) + 1;
+                op.quantity = quantityDist(rng);
+                op.discountRate = 0.0;
+
+                // Mix: 50% add, 25% remove, 10% discount, 15% checkout
+                double pick = unit(rng);
+                if (pick < 0.50) {
+                    op.type = OperationType::AddToCart;
+                } else if (pick < 0.75) {
+                    op.type = OperationType::RemoveFromCart;
+                } else if (pick < 0.85) {
+                    op.type = OperationType::ApplyDiscount;
+                    op.discountRate = 0.05 * quantityDist(rng);
+                } else {
+                    op.type = OperationType::Checkout;
+                }
+                trace.addOperation(op);
+            }
+        }
+        return trace;
+    }
+};
+
+// Throughput and latency summary of one load run
+struct LoadReport {
+    size_t operations = 0;
+    double elapsedSeconds = 0.0;
+    double p50Micros = 0.0;
+    double p99Micros = 0.0;
+    double p999Micros = 0.0;
+
+    double getThroughput() const {
+        return elapsedSeconds > 0.0 ? operations / elapsedSeconds : 0.0;
+    }
+
+    void display() const {
+        cout << "\n============= LOAD REPORT =============\n";
+        cout << "Operations: " << operations << "\n";
+        cout << "Elapsed: " << fixed << setprecision(3) << elapsedSeconds << " s\n";
+        cout << "Throughput: " << setprecision(0) << getThroughput() << " ops/s\n";
+        cout << "Latency p50: " << setprecision(1) << p50Micros << " us\n";
+        cout << "Latency p99: " << p99Micros << " us\n";
+        cout << "Latency p999: " << p999Micros << " us\n";
+        cout << "========================================\n";
+    }
+};
+
+// Replays a trace with one thread per shopper against a shared catalog
+class LoadDriver {
+private:
+    using Clock = chrono::steady_clock;
+
+    static shared_ptr<Product> makeProduct(const CatalogEntry& entry) {
+        if (entry.electronics) {
+            return make_shared<Electronics>(entry.id, entry.name, entry.price, entry.stock,
+                                            entry.warranty, entry.brand);
+        }
+        return make_shared<Product>(entry.id, entry.name, entry.price, entry.stock);
+    }
+
+    // Nearest-rank percentile of sorted samples
+    static double percentile(const vector<double>& sorted, double fraction) {
+        if (sorted.empty()) {
+            return 0.0;
+        }
+        size_t rank = static_cast<size_t>(ceil(fraction * sorted.size()));
+        return sorted[rank > 0 ? rank - 1 : 0];
+    }
+
+public:
+    LoadReport run(const WorkloadTrace& trace, bool trackViews = true) const {
+        const int shopperCount = trace.getShopperCount();
+        vector<shared_ptr<Product>> catalog;
+        catalog.reserve(trace.getCatalog().size());
+        for (const auto& entry : trace.getCatalog()) {
+            catalog.push_back(makeProduct(entry));
+        }
+
+        // Store operations print to cout and mutate shared stock, so each runs under one lock
+        mutex storeMutex;
+        NullBuffer nullBuffer;
+        streambuf* originalBuffer = cout.rdbuf(&nullBuffer);
+
+        // All shoppers share one catalog, so they share one set of inventory views
+        auto sharedViews = make_shared<InventoryViews>();
+        vector<ECommerceManager> shoppers;
+        shoppers.reserve(shopperCount);
+        for (int s = 0; s < shopperCount; ++s) {
+            shoppers.emplace_back(sharedViews);
+            shoppers.back().setViewTracking(trackViews);
+        }
+        for (auto& shopper : shoppers) {
+            for (const auto& product : catalog) {
+                shopper.addProductToInventory(product);
+            }
+        }
+
+        vector<vector<WorkloadOperation>> perShopper(shopperCount);
+        for (const auto& op : trace.getOperations()) {
+            perShopper[op.shopperId].push_back(op);
+        }
+        vector<vector<double>> latencies(shopperCount);
+
+        // Latency is measured from the scheduled start, so queueing delay is included
+        Clock::time_point start = Clock::now();
+        vector<thread> workers;
+        for (int s = 0; s < shopperCount; ++s) {
+            workers.emplace_back([&, s]() {
+                latencies[s].reserve(perShopper[s].size());
+                for (const auto& op : perShopper[s]) {
+                    Clock::time_point scheduled = start + chrono::microseconds(op.offsetMicros);
+                    this_thread::sleep_until(scheduled);
+                    {
+                        lock_guard<mutex> lock(storeMutex);
+                        switch (op.type) {
+                            case OperationType::AddToCart:
+                                shoppers[s].addToCart(op.productId, op.quantity);
+                                break;
+                            case OperationType::RemoveFromCart:
+                                shoppers[s].removeFromCart(op.productId);
+                                break;
+                            case OperationType::ApplyDiscount:
+                                shoppers[s].applyCartDiscount(op.discountRate);
+                                break;
+                            case OperationType::Checkout:
+                                shoppers[s].checkout();
+                                break;
+                        }
+                    }
+                    latencies[s].push_back(
+                        chrono::duration<double, micro>(Clock::now() - scheduled).count());
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        double elapsed = chrono::duration<double>(Clock::now() - start).count();
+        cout.rdbuf(originalBuffer);
+
+        vector<double> all;
+        for (const auto& samples : latencies) {
+            all.insert(all.end(), samples.begin(), samples.end());
+        }
+        sort(all.begin(), all.end());
+
+        LoadReport report;
+        report.operations = all.size();
+        report.elapsedSeconds = elapsed;
+        report.p50Micros = percentile(all, 0.50);
+        report.p99Micros = percentile(all, 0.99);
+        report.p999Micros = percentile(all, 0.999);
+        return report;
+    }
+};
+
+// Command-line entry for load generation:
+//   --loadgen [--catalog N] [--electronics F] [--zipf S] [--stock N]
+//             [--shoppers N] [--ops N] [--rate R] [--seed N] [--record FILE] [--views on|off]
+//   --replay FILE [--views on|off]
+// --views off skips inventory-view maintenance, to measure its overhead on the same traffic
+int runLoadTool(int argc, char* argv[]) {
+    string mode = argv[1];
+    WorkloadTrace trace;
+    bool trackViews = true;
+
+    auto parseViews = [&](const string& value) {
+        if (value != "on" && value != "off") {
+            cout << "Error: --views expects 'on' or 'off'.\n";
+            return false;
+        }
+        trackViews = (value == "on");
+        return true;
+    };
+
+    if (mode == "--replay") {
+        if (argc < 3) {
+            cout << "Error: --replay requires a trace file.\n";
+            return 1;
+        }
+        for (int i = 3; i < argc; i += 2) {
+            if (string(argv[i]) != "--views" || i + 1 >= argc) {
+                cout << "Error: Unknown or incomplete option " << argv[i] << "\n";
+                return 1;
+            }
+            if (!parseViews(argv[i + 1])) {
+                return 1;
+            }
+        }
+        if (!trace.loadFromFile(argv[2])) {
+            return 1;
+        }
+        cout << "Replaying " << trace.getOperations().size() << " operations over "
+             << trace.getCatalog().size() << " recorded products from '" << argv[2] << "'...\n";
+    } else if (mode == "--loadgen") {
+        LoadConfig config;
+        string recordPath;
+        try {
+            for (int i = 2; i < argc; ++i) {
+                string option = argv[i];
+                if (i + 1 >= argc) {
+                    cout << "Error: Missing value for option " << option << "\n";
+                    return 1;
+                }
+                string value = argv[++i];
+                if (option == "--catalog") config.catalogSize = stoi(value);
+                else if (option == "--electronics") config.electronicsRatio = stod(value);
+                else if (option == "--zipf") config.zipfExponent = stod(value);
+                else if (option == "--stock") config.initialStock = stoi(value);
+                else if (option == "--shoppers") config.shoppers = stoi(value);
+                else if (option == "--ops") config.operationsPerShopper = stoi(value);
+                else if (option == "--rate") config.targetRate = stod(value);
+                else if (option == "--seed") config.seed = static_cast<unsigned>(stoul(value));
+                else if (option == "--record") recordPath = value;
+                else if (option == "--views") {
+                    if (!parseViews(value)) {
+                        return 1;
+                    }
+                }
+                else {
+                    cout << "Error: Unknown option " << option << "\n";
+                    return 1;
+                }
+            }
+        } catch (const exception&) {
+            cout << "Error: Invalid numeric option value.\n";
+            return 1;
+        }
+        if (!config.isValid()) {
+            cout << "Error: Load configuration values out of range.\n";
+            return 1;
+        }
+
+        trace = WorkloadGenerator(config).generateTrace();
+        cout << "Generated " << trace.getOperations().size() << " operations for "
+             << config.shoppers << " shoppers over " << config.catalogSize << " products.\n";
+        if (!recordPath.empty()) {
+            if (!trace.saveToFile(recordPath)) {
+                return 1;
+            }
+            cout << "Workload trace recorded to '" << recordPath << "'.\n";
+        }
+    } else {
+        cout << "Error: Unknown mode " << mode << ". Use --loadgen or --replay FILE.\n";
+        return 1;
+    }
+
+    cout << "Inventory views: " << (trackViews ? "on" : "off") << "\n";
+    LoadReport report = LoadDriver().run(trace, trackViews);
+    report.display();
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    // Load generation / replay mode (see runLoadTool)
+    if (argc > 1) {
+        return runLoadTool(argc, argv);
+    }
+
     cout << "=========== E-COMMERCE PRODUCT MANAGEMENT SYSTEM ===========\n";
     cout << "Demonstrating ALL Object-Oriented Programming Concepts\n";
     cout << "============================================================\n\n";
@@ -682,7 +2077,7 @@ int main() {
     
     // Template with integers
     cout << "Testing InventoryList<int> for order IDs:\n";
-    InventoryList<int> orderIds;
+    InventoryList<int, SortedVectorStorage<int>> orderIds; // kept sorted, binary search
     orderIds.addItem(1001);
     orderIds.addItem(1002);
     orderIds.addItem(1003);
@@ -767,5 +2162,51 @@ int main() {
     newBook = *book; // Uses assignment operator
     cout << "Assigned product: " << newBook << "\n";
 
+    // 9. BATCH STOCK UPDATES AND INVENTORY VIEWS
+    cout << "\n9. TESTING BATCH STOCK UPDATES AND INVENTORY VIEWS\n";
+    vector<pair<int, int>> deltas = {{101, 5}, {201, -100}, {999, 3}, {102, -14}};
+    mt19937 rng(2024);
+    for (int i = 0; i < 100000; ++i) {
+        int ids[] = {101, 102, 201};
+        deltas.push_back(make_pair(ids[rng() % 3], static_cast<int>(rng() % 7) - 3));
+    }
+    vector<StockDeltaResult> results = manager.applyStockDeltas(deltas);
+    const char* statusNames[] = {"Applied", "ProductNotFound", "InsufficientStock", "StockOverflow"};
+    cout << "First entries: ";
+    for (size_t i = 0; i < 4; ++i) {
+        cout << results[i].productId << ":" << statusNames[static_cast<int>(results[i].status)] << " ";
+    }
+    cout << "\n";
+
+    // Second sync drains the book and leaves the phone low on stock
+    manager.applyStockDeltas({{201, -book->getStock()}, {102, 3 - phone->getStock()}});
+
+    // Views are maintained incrementally; compare with a full rescan of the inventory
+    const InventoryViews& views = manager.getInventoryViews();
+    double scanTotal = 0.0, scanElectronics = 0.0, scanAsus = 0.0;
+    size_t scanOutOfStock = 0;
+    for (const auto& product : manager.getInventoryProducts()) {
+        double value = product->getPrice() * product->getStock();
+        scanTotal += value;
+        if (auto electronics = dynamic_pointer_cast<Electronics>(product)) {
+            scanElectronics += value;
+            if (electronics->getBrand() == "ASUS") {
+                scanAsus += value;
+            }
+        }
+        scanOutOfStock += (product->getStock() == 0) ? 1 : 0;
+    }
+    cout << fixed << setprecision(2);
+    cout << "Total inventory value:  view $" << views.getTotalValue() << " | rescan $" << scanTotal << "\n";
+    cout << "Electronics value:      view $" << views.getCategoryValue(ProductCategory::Electronics) 
+         << " | rescan $" << scanElectronics << "\n";
+    cout << "ASUS brand value:       view $" << views.getBrandValue("ASUS") << " | rescan $" << scanAsus << "\n";
+    cout << "Out-of-stock products:  view " << views.getOutOfStockCount() << " | rescan " << scanOutOfStock << "\n";
+    cout << "Low-stock products (< " << views.getLowStockThreshold() << " units):";
+    for (const auto& product : views.getLowStockProducts()) {
+        cout << " " << product->getName() << "(" << product->getStock() << ")";
+    }
+    cout << "\n";
+
     return 0;
 }
\ No newline at end of file